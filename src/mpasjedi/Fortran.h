@@ -56,6 +56,8 @@ typedef int F90odb;
 typedef int F90getvalues;
 // LinearGetValues key
 typedef int F90lineargetvalues;
+// Location pool key
+typedef int F90locationpool;
 
 /// Interface to Fortran MPAS model
 /*!
@@ -76,12 +78,13 @@ extern "C" {
                     atlas::functionspace::FunctionSpaceImpl *);
   void mpas_geo_fill_atlas_fieldset_f90(const F90geom &,
                                         atlas::field::FieldSetImpl *);
-  void mpas_geo_clone_f90(F90geom &, const F90geom &);
   void mpas_geo_is_equal_f90(bool &, const F90geom &, const F90geom &);
   void mpas_geo_vars_nlevels_f90(const F90geom &, const oops::Variables &,
                                  const std::size_t &, std::size_t &);
   void mpas_geo_info_f90(const F90geom &, int &, int &, int &, int &, int &,
                          int &, int &, int &);
+  void mpas_geo_field_pool_stats_f90(const F90geom &, std::size_t &, std::size_t &,
+                                     std::size_t &, std::size_t &);
   void mpas_geo_delete_f90(F90geom &);
 
 // -----------------------------------------------------------------------------
@@ -13,12 +13,26 @@
 #include "oops/util/Logger.h"
 
 #include "mpasjedi/GeometryMPAS.h"
+#include "mpasjedi/getvalues/LocationPool.h"
+#include "mpasjedi/getvalues/Model2GeoVarsCache.h"
 
 // -----------------------------------------------------------------------------
 namespace mpas {
 // -----------------------------------------------------------------------------
 GeometryMPAS::GeometryMPAS(const eckit::Configuration & config,
-                           const eckit::mpi::Comm & comm) : comm_(comm) {
+                           const eckit::mpi::Comm & comm) : comm_(comm),
+  data_(new GeometryData(config, comm)) {}
+// -----------------------------------------------------------------------------
+GeometryMPAS::GeometryMPAS(const GeometryMPAS & other) : comm_(other.comm_),
+  data_(other.data_) {
+  oops::Log::trace() << "GeometryMPAS copy shares the mesh, use count = "
+                     << data_.use_count() << std::endl;
+}
+// -----------------------------------------------------------------------------
+GeometryMPAS::~GeometryMPAS() {}
+// -----------------------------------------------------------------------------
+GeometryMPAS::GeometryData::GeometryData(const eckit::Configuration & config,
+                                         const eckit::mpi::Comm & comm) {
   oops::Log::trace() << "========= GeometryMPAS::GeometryMPAS step 1 =========="
                      << std::endl;
   mpas_geo_setup_f90(keyGeom_, config, &comm);
@@ -43,29 +57,22 @@ GeometryMPAS::GeometryMPAS(const eckit::Configuration & config,
                      << std::endl;
 }
 // -----------------------------------------------------------------------------
-GeometryMPAS::GeometryMPAS(const GeometryMPAS & other) : comm_(other.comm_) {
-  oops::Log::trace() << "========= GeometryMPAS mpas_geo_clone_f90   =========="
+GeometryMPAS::GeometryData::~GeometryData() {
+  size_t nrequests, nhits, nreleases, nkept;
+  mpas_geo_field_pool_stats_f90(keyGeom_, nrequests, nhits, nreleases, nkept);
+  oops::Log::trace() << "GeometryMPAS field pools: " << nrequests << " requests, "
+                     << nrequests - nhits << " allocations, hit rate "
+                     << (nrequests > 0 ? 100 * nhits / nrequests : 0) << "%, "
+                     << nkept << " of " << nreleases << " released pools kept"
                      << std::endl;
-  mpas_geo_clone_f90(keyGeom_, other.keyGeom_);
-  atlasFunctionSpace_.reset(new atlas::functionspace::PointCloud(
-                              other.atlasFunctionSpace_->lonlat()));
-  mpas_geo_set_atlas_functionspace_pointer_f90(keyGeom_,
-    atlasFunctionSpace_->get());
-  atlasFieldSet_.reset(new atlas::FieldSet());
-  for (int jfield = 0; jfield < other.atlasFieldSet_->size(); ++jfield) {
-    atlas::Field atlasField = other.atlasFieldSet_->field(jfield);
-    atlasFieldSet_->add(atlasField);
-  }
-}
-// -----------------------------------------------------------------------------
-GeometryMPAS::~GeometryMPAS() {
   mpas_geo_delete_f90(keyGeom_);
 }
 // -----------------------------------------------------------------------------
 bool GeometryMPAS::isEqual(const GeometryMPAS & other) const {
   bool isEqual;
 
-  mpas_geo_is_equal_f90(isEqual, keyGeom_, other.keyGeom_);
+  if (data_ == other.data_) return true;
+  mpas_geo_is_equal_f90(isEqual, data_->keyGeom_, other.data_->keyGeom_);
 
   return isEqual;
 }
@@ -74,11 +81,29 @@ std::vector<size_t> GeometryMPAS::variableSizes(const oops::Variables & vars) co
   // vector of level counts
   std::vector<size_t> varSizes(vars.size());
 
-  mpas_geo_vars_nlevels_f90(keyGeom_, vars, vars.size(), varSizes[0]);
+  mpas_geo_vars_nlevels_f90(data_->keyGeom_, vars, vars.size(), varSizes[0]);
 
   return varSizes;
 }
 // -----------------------------------------------------------------------------
+std::shared_ptr<Model2GeoVarsCache> GeometryMPAS::model2GeoVarsCache() const {
+  std::shared_ptr<Model2GeoVarsCache> cache = data_->model2GeoVarsCache_.lock();
+  if (!cache) {
+    cache.reset(new Model2GeoVarsCache());
+    data_->model2GeoVarsCache_ = cache;
+  }
+  return cache;
+}
+// -----------------------------------------------------------------------------
+std::shared_ptr<LocationPool> GeometryMPAS::locationPool() const {
+  std::shared_ptr<LocationPool> pool = data_->locationPool_.lock();
+  if (!pool) {
+    pool.reset(new LocationPool());
+    data_->locationPool_ = pool;
+  }
+  return pool;
+}
+// -----------------------------------------------------------------------------
 void GeometryMPAS::print(std::ostream & os) const {
   int nCellsGlobal;
   int nCells;
@@ -88,7 +113,7 @@ void GeometryMPAS::print(std::ostream & os) const {
   int nEdgesSolve;
   int nVertLevels;
   int nVertLevelsP1;
-  mpas_geo_info_f90(keyGeom_, nCellsGlobal, nCells, nCellsSolve, \
+  mpas_geo_info_f90(data_->keyGeom_, nCellsGlobal, nCells, nCellsSolve, \
                               nEdgesGlobal, nEdges, nEdgesSolve, \
                               nVertLevels, nVertLevelsP1);
 
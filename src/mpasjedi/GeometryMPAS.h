@@ -29,9 +29,27 @@ namespace eckit {
 }
 
 namespace mpas {
+  class LocationPool;
+  class Model2GeoVarsCache;
 
 // -----------------------------------------------------------------------------
 /// GeometryMPAS handles geometry for MPAS model.
+/*!
+ * The mesh is read once per construction from a configuration. The mesh arrays
+ * and the atlas function space are not changed afterwards, so copies share them
+ * through a reference count instead of cloning them: copying a GeometryMPAS
+ * costs O(1) time and memory.
+ *
+ * Copies also share some mutable state:
+ * - the Fortran field pool of the mesh, which increments take fields from and
+ *   return them to (acquire / release in mpasjedi_field_pool_mod). Every access
+ *   is inside the named omp critical section mpasjedi_field_pool, so increments
+ *   may be created and deleted from several threads.
+ * - the slots of the Model2GeoVars cache and of the location pool, which are
+ *   reassigned when the previous cache or pool has been deleted. They, and the
+ *   cache and pool they point to, are not synchronised: GetValues and
+ *   LinearGetValues must be created and used from one thread at a time.
+ */
 
 class GeometryMPAS : public util::Printable,
                       private util::ObjectCounter<GeometryMPAS> {
@@ -42,26 +60,41 @@ class GeometryMPAS : public util::Printable,
   GeometryMPAS(const GeometryMPAS &);
   ~GeometryMPAS();
 
-  F90geom & toFortran() {return keyGeom_;}
-  const F90geom & toFortran() const {return keyGeom_;}
+  const F90geom & toFortran() const {return data_->keyGeom_;}
   const eckit::mpi::Comm & getComm() const {return comm_;}
 
   atlas::FunctionSpace * atlasFunctionSpace() const
-    {return atlasFunctionSpace_.get();}
+    {return data_->atlasFunctionSpace_.get();}
   atlas::FieldSet * atlasFieldSet() const
-    {return atlasFieldSet_.get();}
+    {return data_->atlasFieldSet_.get();}
 
   bool isEqual(const GeometryMPAS &) const;
 
   std::vector<size_t> variableSizes(const oops::Variables &) const;
 
+  /// Model2GeoVars results shared by all users of this geometry and its copies
+  std::shared_ptr<Model2GeoVarsCache> model2GeoVarsCache() const;
+
+  /// Observation locations shared by the GetValues on this geometry and its copies
+  std::shared_ptr<LocationPool> locationPool() const;
+
  private:
+  /// Fortran mesh and atlas objects shared by a geometry and all its copies (see above)
+  struct GeometryData {
+    GeometryData(const eckit::Configuration &, const eckit::mpi::Comm &);
+    ~GeometryData();
+    F90geom keyGeom_;
+    std::unique_ptr<atlas::functionspace::PointCloud> atlasFunctionSpace_;
+    std::unique_ptr<atlas::FieldSet> atlasFieldSet_;
+    // The caches live as long as one of their users; the geometry only keeps the slot
+    mutable std::weak_ptr<Model2GeoVarsCache> model2GeoVarsCache_;
+    mutable std::weak_ptr<LocationPool> locationPool_;
+  };
+
   GeometryMPAS & operator=(const GeometryMPAS &);
   void print(std::ostream &) const;
-  F90geom keyGeom_;
   const eckit::mpi::Comm & comm_;
-  std::unique_ptr<atlas::functionspace::PointCloud> atlasFunctionSpace_;
-  std::unique_ptr<atlas::FieldSet> atlasFieldSet_;
+  std::shared_ptr<const GeometryData> data_;
 };
 // -----------------------------------------------------------------------------
 
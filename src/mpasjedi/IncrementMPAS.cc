@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <iomanip>
 #include <iostream>
+#include <utility>
 #include <vector>
 
 #include "eckit/config/LocalConfiguration.h"
@@ -39,6 +40,8 @@ IncrementMPAS::IncrementMPAS(const GeometryMPAS & resol,
   : geom_(new GeometryMPAS(resol)), vars_(other.vars_), time_(other.time_)
 {
   mpas_increment_create_f90(keyInc_, geom_->toFortran(), vars_);
+  // the interpolation only sets the owned cells, and recycled fields keep old halos
+  mpas_increment_zero_f90(keyInc_);
   mpas_increment_change_resol_f90(keyInc_, other.keyInc_);
   oops::Log::trace() << "IncrementMPAS constructed from other." << std::endl;
 }
@@ -46,10 +49,10 @@ IncrementMPAS::IncrementMPAS(const GeometryMPAS & resol,
 IncrementMPAS::IncrementMPAS(const IncrementMPAS & other, const bool copy)
   : geom_(other.geom_), vars_(other.vars_), time_(other.time_)
 {
-  mpas_increment_create_f90(keyInc_, geom_->toFortran(), vars_);
   if (copy) {
-    mpas_increment_copy_f90(keyInc_, other.keyInc_);
+    mpas_increment_clone_f90(keyInc_, other.keyInc_);
   } else {
+    mpas_increment_create_f90(keyInc_, geom_->toFortran(), vars_);
     mpas_increment_zero_f90(keyInc_);
   }
   oops::Log::trace() << "IncrementMPAS copy-created." << std::endl;
@@ -58,13 +61,20 @@ IncrementMPAS::IncrementMPAS(const IncrementMPAS & other, const bool copy)
 IncrementMPAS::IncrementMPAS(const IncrementMPAS & other)
   : geom_(other.geom_), vars_(other.vars_), time_(other.time_)
 {
-  mpas_increment_create_f90(keyInc_, geom_->toFortran(), vars_);
-  mpas_increment_copy_f90(keyInc_, other.keyInc_);
+  mpas_increment_clone_f90(keyInc_, other.keyInc_);
   oops::Log::trace() << "IncrementMPAS copy-created." << std::endl;
 }
 // -----------------------------------------------------------------------------
+IncrementMPAS::IncrementMPAS(IncrementMPAS && other)
+  : keyInc_(other.keyInc_), geom_(other.geom_), vars_(other.vars_),
+    time_(other.time_)
+{
+  other.keyInc_ = 0;
+  oops::Log::trace() << "IncrementMPAS moved." << std::endl;
+}
+// -----------------------------------------------------------------------------
 IncrementMPAS::~IncrementMPAS() {
-  mpas_increment_delete_f90(keyInc_);
+  if (keyInc_ != 0) mpas_increment_delete_f90(keyInc_);
   oops::Log::trace() << "IncrementMPAS destructed" << std::endl;
 }
 // -----------------------------------------------------------------------------
@@ -92,26 +102,37 @@ void IncrementMPAS::diff(const StateMPAS & x1, const StateMPAS & x2) {
 }
 // -----------------------------------------------------------------------------
 IncrementMPAS & IncrementMPAS::operator=(const IncrementMPAS & rhs) {
-  mpas_increment_copy_f90(keyInc_, rhs.keyInc_);
+  if (keyInc_ == 0) {
+    // moved-from, so there are no fields to copy into
+    geom_ = rhs.geom_;
+    vars_ = rhs.vars_;
+    mpas_increment_clone_f90(keyInc_, rhs.keyInc_);
+  } else {
+    mpas_increment_copy_f90(keyInc_, rhs.keyInc_);
+  }
   time_ = rhs.time_;
   return *this;
 }
 // -----------------------------------------------------------------------------
-IncrementMPAS & IncrementMPAS::operator+=(const IncrementMPAS & dx) {
-  ASSERT(this->validTime() == dx.validTime());
-  mpas_increment_self_add_f90(keyInc_, dx.keyInc_);
+IncrementMPAS & IncrementMPAS::operator=(IncrementMPAS && rhs) {
+  // rhs takes the old fields of this and releases them when it goes away
+  std::swap(keyInc_, rhs.keyInc_);
+  std::swap(geom_, rhs.geom_);
+  std::swap(vars_, rhs.vars_);
+  time_ = rhs.time_;
   return *this;
 }
 // -----------------------------------------------------------------------------
+IncrementMPAS & IncrementMPAS::operator+=(const IncrementMPAS & dx) {
+  return fused(*this + 1.0 * dx);
+}
+// -----------------------------------------------------------------------------
 IncrementMPAS & IncrementMPAS::operator-=(const IncrementMPAS & dx) {
-  ASSERT(this->validTime() == dx.validTime());
-  mpas_increment_self_sub_f90(keyInc_, dx.keyInc_);
-  return *this;
+  return fused(*this - 1.0 * dx);
 }
 // -----------------------------------------------------------------------------
 IncrementMPAS & IncrementMPAS::operator*=(const double & zz) {
-  mpas_increment_self_mul_f90(keyInc_, zz);
-  return *this;
+  return fused(zz * *this);
 }
 // -----------------------------------------------------------------------------
 void IncrementMPAS::zero() {
@@ -129,8 +150,7 @@ void IncrementMPAS::ones() {
 // -----------------------------------------------------------------------------
 void IncrementMPAS::axpy(const double & zz, const IncrementMPAS & dx,
                        const bool check) {
-  ASSERT(!check || this->validTime() == dx.validTime());
-  mpas_increment_axpy_inc_f90(keyInc_, zz, dx.keyInc_);
+  fused(*this + zz * dx, check);
 }
 // -----------------------------------------------------------------------------
 void IncrementMPAS::axpy(const double & zz, const StateMPAS & xx,
@@ -153,6 +173,49 @@ double IncrementMPAS::dot_product_with(const IncrementMPAS & other) const {
   return zz;
 }
 // -----------------------------------------------------------------------------
+std::vector<double> IncrementMPAS::dot_products_with(
+    const std::vector<const IncrementMPAS *> & others) const {
+  std::vector<F90inc> keys;
+  keys.reserve(others.size());
+  for (const IncrementMPAS * other : others) keys.push_back(other->keyInc_);
+  std::vector<double> zz(others.size());
+  const int nn = others.size();
+  mpas_increment_dot_prods_f90(keyInc_, nn, keys.data(), zz.data());
+  return zz;
+}
+// -----------------------------------------------------------------------------
+void IncrementMPAS::dot_product_start(const IncrementMPAS & other,
+                                      DotProductRequest & request) const {
+  ASSERT(!request.pending_);
+  mpas_increment_dot_prod_start_f90(keyInc_, other.keyInc_, request.local_,
+                                    request.global_, request.request_);
+  request.pending_ = true;
+}
+// -----------------------------------------------------------------------------
+double IncrementMPAS::dot_product_finish(DotProductRequest & request) const {
+  ASSERT(request.pending_);
+  mpas_increment_dot_prod_finish_f90(request.request_);
+  request.pending_ = false;
+  return request.global_;
+}
+// -----------------------------------------------------------------------------
+DotProductRequest::~DotProductRequest() {
+  if (pending_) mpas_increment_dot_prod_finish_f90(request_);
+}
+// -----------------------------------------------------------------------------
+double IncrementMPAS::axpy_and_dot(const double & zz, const IncrementMPAS & dx,
+                                   const IncrementMPAS & other,
+                                   const bool check) {
+  ASSERT(!check || this->validTime() == dx.validTime());
+  if (&dx == this) {
+    *this *= 1.0 + zz;
+    return dot_product_with(other);
+  }
+  double zprod;
+  mpas_increment_axpy_dot_f90(keyInc_, zz, dx.keyInc_, other.keyInc_, zprod);
+  return zprod;
+}
+// -----------------------------------------------------------------------------
 void IncrementMPAS::random() {
   mpas_increment_random_f90(keyInc_);
 }
@@ -233,6 +296,17 @@ double IncrementMPAS::norm() const {
   return zz;
 }
 // -----------------------------------------------------------------------------
+std::vector<double> IncrementMPAS::norms(
+    const std::vector<const IncrementMPAS *> & dxs) {
+  std::vector<F90inc> keys;
+  keys.reserve(dxs.size());
+  for (const IncrementMPAS * dx : dxs) keys.push_back(dx->keyInc_);
+  std::vector<double> zz(dxs.size());
+  const int nn = dxs.size();
+  mpas_increment_rms_batch_f90(nn, keys.data(), zz.data());
+  return zz;
+}
+// -----------------------------------------------------------------------------
 void IncrementMPAS::print(std::ostream & os) const {
   // store os fmt state
   std::ios oldState(nullptr);
@@ -8,6 +8,8 @@
 #ifndef MPASJEDI_INCREMENTMPAS_H_
 #define MPASJEDI_INCREMENTMPAS_H_
 
+#include <array>
+#include <cstddef>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -15,6 +17,8 @@
 
 #include "atlas/field.h"
 
+#include "eckit/exception/Exceptions.h"
+
 #include "oops/base/Variables.h"
 #include "oops/util/DateTime.h"
 #include "oops/util/dot_product.h"
@@ -23,6 +27,7 @@
 #include "oops/util/Printable.h"
 #include "oops/util/Serializable.h"
 
+#include "mpasjedi/IncrementMPASExpression.h"
 #include "mpasjedi/IncrementMPASFortran.h"
 
 namespace eckit {
@@ -43,6 +48,33 @@ namespace mpas {
   class GetValuesTrajMPAS;
   class StateMPAS;
 
+/// Global sum of a dot product started by IncrementMPAS::dot_product_start
+/*!
+ *  MPI writes into this object while the sum is in flight, so it can be
+ *  neither copied nor moved. An unfinished sum is waited for on destruction.
+ */
+
+// -----------------------------------------------------------------------------
+
+class DotProductRequest {
+ public:
+  DotProductRequest() {}
+  DotProductRequest(const DotProductRequest &) = delete;
+  DotProductRequest & operator=(const DotProductRequest &) = delete;
+  ~DotProductRequest();
+
+  bool pending() const {return pending_;}
+
+ private:
+  friend class IncrementMPAS;
+  double local_ = 0.0;
+  double global_ = 0.0;
+  int request_ = 0;
+  bool pending_ = false;
+};
+
+// -----------------------------------------------------------------------------
+
 /// Increment Class: Difference between two states
 /*!
  *  Some fields that are present in a State may not be present in
@@ -64,6 +96,7 @@ class IncrementMPAS : public util::Printable,
   IncrementMPAS(const GeometryMPAS &, const IncrementMPAS &);
   IncrementMPAS(const IncrementMPAS &, const bool);
   IncrementMPAS(const IncrementMPAS &);
+  IncrementMPAS(IncrementMPAS &&);
   virtual ~IncrementMPAS();
 
 /// Basic operators
@@ -72,12 +105,23 @@ class IncrementMPAS : public util::Printable,
   void zero(const util::DateTime &);
   void ones();
   IncrementMPAS & operator =(const IncrementMPAS &);
+  IncrementMPAS & operator =(IncrementMPAS &&);
   IncrementMPAS & operator+=(const IncrementMPAS &);
   IncrementMPAS & operator-=(const IncrementMPAS &);
   IncrementMPAS & operator*=(const double &);
   void axpy(const double &, const IncrementMPAS &, const bool check = true);
   void axpy(const double &, const StateMPAS &, const bool check = true);
   double dot_product_with(const IncrementMPAS &) const;
+  std::vector<double> dot_products_with(
+    const std::vector<const IncrementMPAS *> &) const;
+  void dot_product_start(const IncrementMPAS &, DotProductRequest &) const;
+  double dot_product_finish(DotProductRequest &) const;
+
+/// Fused operators
+  template <std::size_t N>
+  IncrementMPAS & fused(const IncrementLinComb<N> &, const bool check = true);
+  double axpy_and_dot(const double &, const IncrementMPAS &,
+                      const IncrementMPAS &, const bool check = true);
   void schur_product_with(const IncrementMPAS &);
   void random();
   void dirac(const eckit::Configuration &);
@@ -91,6 +135,7 @@ class IncrementMPAS : public util::Printable,
   void read(const eckit::Configuration &);
   void write(const eckit::Configuration &) const;
   double norm() const;
+  static std::vector<double> norms(const std::vector<const IncrementMPAS *> &);
 
   void updateTime(const util::Duration & dt) {time_ += dt;}
 
@@ -115,12 +160,40 @@ class IncrementMPAS : public util::Printable,
 /// Data
  private:
   void print(std::ostream &) const override;
-  F90inc keyInc_;
+  F90inc keyInc_;  // 0 once the fields have been moved to another IncrementMPAS
   std::shared_ptr<const GeometryMPAS> geom_;
   oops::Variables vars_;
   util::DateTime time_;
 };
 // -----------------------------------------------------------------------------
+/// Sets this to the linear combination expr in one pass over the fields
+/*!
+ *  Terms that are this increment itself are folded into the coefficient
+ *  applied to the current values, which are not read when that coefficient
+ *  is zero. The other terms are passed to a kernel specialized for the
+ *  number of terms.
+ */
+template <std::size_t N>
+IncrementMPAS & IncrementMPAS::fused(const IncrementLinComb<N> & expr,
+                                     const bool check) {
+  double zself = 0.0;
+  std::array<double, N> zz;
+  std::array<F90inc, N> keys;
+  int nterms = 0;
+  for (std::size_t k = 0; k < N; ++k) {
+    if (expr.terms[k] == this) {
+      zself += expr.coefs[k];
+    } else {
+      ASSERT(!check || time_ == expr.terms[k]->validTime());
+      zz[nterms] = expr.coefs[k];
+      keys[nterms] = expr.terms[k]->toFortran();
+      ++nterms;
+    }
+  }
+  mpas_increment_lincomb_f90(keyInc_, zself, nterms, zz.data(), keys.data());
+  return *this;
+}
+// -----------------------------------------------------------------------------
 
 }  // namespace mpas
 
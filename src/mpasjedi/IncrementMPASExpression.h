@@ -0,0 +1,109 @@
+/*
+ * (C) Copyright 2020 UCAR
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#ifndef MPASJEDI_INCREMENTMPASEXPRESSION_H_
+#define MPASJEDI_INCREMENTMPASEXPRESSION_H_
+
+#include <array>
+#include <cstddef>
+
+namespace mpas {
+  class IncrementMPAS;
+
+/// Linear combination of N increments, evaluated by IncrementMPAS::fused
+/*!
+ *  Expressions such as a*dx + b*y - z build one of these instead of
+ *  computing anything, so that the number of terms is known at compile time
+ *  and the whole combination can be evaluated in a single pass over the
+ *  fields. It only holds pointers to its terms and must not outlive them.
+ */
+
+// -----------------------------------------------------------------------------
+
+template <std::size_t N>
+struct IncrementLinComb {
+  std::array<double, N> coefs;
+  std::array<const IncrementMPAS *, N> terms;
+};
+
+// -----------------------------------------------------------------------------
+
+inline IncrementLinComb<1> operator*(const double & zz,
+                                     const IncrementMPAS & dx) {
+  return IncrementLinComb<1>{{{zz}}, {{&dx}}};
+}
+
+inline IncrementLinComb<1> operator*(const IncrementMPAS & dx,
+                                     const double & zz) {
+  return zz * dx;
+}
+
+template <std::size_t N>
+IncrementLinComb<N> operator*(const double & zz,
+                              const IncrementLinComb<N> & expr) {
+  IncrementLinComb<N> scaled = expr;
+  for (double & coef : scaled.coefs) coef *= zz;
+  return scaled;
+}
+
+template <std::size_t N>
+IncrementLinComb<N> operator-(const IncrementLinComb<N> & expr) {
+  return -1.0 * expr;
+}
+
+// -----------------------------------------------------------------------------
+
+template <std::size_t N, std::size_t M>
+IncrementLinComb<N + M> operator+(const IncrementLinComb<N> & lhs,
+                                  const IncrementLinComb<M> & rhs) {
+  IncrementLinComb<N + M> sum;
+  for (std::size_t k = 0; k < N; ++k) {
+    sum.coefs[k] = lhs.coefs[k];
+    sum.terms[k] = lhs.terms[k];
+  }
+  for (std::size_t k = 0; k < M; ++k) {
+    sum.coefs[N + k] = rhs.coefs[k];
+    sum.terms[N + k] = rhs.terms[k];
+  }
+  return sum;
+}
+
+template <std::size_t N, std::size_t M>
+IncrementLinComb<N + M> operator-(const IncrementLinComb<N> & lhs,
+                                  const IncrementLinComb<M> & rhs) {
+  return lhs + (-1.0 * rhs);
+}
+
+template <std::size_t N>
+IncrementLinComb<N + 1> operator+(const IncrementLinComb<N> & lhs,
+                                  const IncrementMPAS & dx) {
+  return lhs + 1.0 * dx;
+}
+
+template <std::size_t N>
+IncrementLinComb<N + 1> operator+(const IncrementMPAS & dx,
+                                  const IncrementLinComb<N> & rhs) {
+  return 1.0 * dx + rhs;
+}
+
+template <std::size_t N>
+IncrementLinComb<N + 1> operator-(const IncrementLinComb<N> & lhs,
+                                  const IncrementMPAS & dx) {
+  return lhs + (-1.0) * dx;
+}
+
+template <std::size_t N>
+IncrementLinComb<N + 1> operator-(const IncrementMPAS & dx,
+                                  const IncrementLinComb<N> & rhs) {
+  return 1.0 * dx + (-1.0 * rhs);
+}
+
+// -----------------------------------------------------------------------------
+
+}  // namespace mpas
+
+#endif  // MPASJEDI_INCREMENTMPASEXPRESSION_H_
@@ -33,6 +33,7 @@ extern "C" {
 // -----------------------------------------------------------------------------
   void mpas_increment_create_f90(F90inc &, const F90geom &,
                              const oops::Variables &);
+  void mpas_increment_clone_f90(F90inc &, const F90inc &);
   void mpas_increment_delete_f90(F90inc &);
   void mpas_increment_copy_f90(const F90inc &, const F90inc &);
   void mpas_increment_zero_f90(const F90inc &);
@@ -51,12 +52,22 @@ extern "C" {
                                  const util::DateTime &);
   void mpas_increment_gpnorm_f90(const F90inc &, const int &, double &);
   void mpas_increment_rms_f90(const F90inc &, double &);
+  void mpas_increment_rms_batch_f90(const int &, const F90inc[], double[]);
   void mpas_increment_diff_incr_f90(const F90inc &, const F90state &,
                                     const F90state &);
   void mpas_increment_self_add_f90(const F90inc &, const F90inc &);
   void mpas_increment_self_sub_f90(const F90inc &, const F90inc &);
   void mpas_increment_self_mul_f90(const F90inc &, const double &);
   void mpas_increment_dot_prod_f90(const F90inc &, const F90inc &, double &);
+  void mpas_increment_dot_prods_f90(const F90inc &, const int &,
+                                    const F90inc[], double[]);
+  void mpas_increment_dot_prod_start_f90(const F90inc &, const F90inc &,
+                                         double &, double &, int &);
+  void mpas_increment_dot_prod_finish_f90(int &);
+  void mpas_increment_lincomb_f90(const F90inc &, const double &, const int &,
+                                  const double[], const F90inc[]);
+  void mpas_increment_axpy_dot_f90(const F90inc &, const double &,
+                                   const F90inc &, const F90inc &, double &);
   void mpas_increment_self_schur_f90(const F90inc &, const F90inc &);
   void mpas_increment_random_f90(const F90inc &);
   void mpas_increment_set_atlas_f90(const F90inc &,
@@ -6,8 +6,10 @@
  */
 
 #include <algorithm>
+#include <atomic>
 #include <iomanip>
 #include <iostream>
+#include <utility>
 #include <vector>
 
 #include "eckit/config/LocalConfiguration.h"
@@ -23,6 +25,10 @@
 
 namespace mpas {
 
+namespace {
+  /// Source of StateMPAS content stamps, never reused within a run
+  std::atomic<size_t> lastStamp(0);
+}
 
 // -----------------------------------------------------------------------------
 /// Constructor, destructor
@@ -34,6 +40,7 @@ StateMPAS::StateMPAS(const GeometryMPAS & geom,
 {
   oops::Log::trace() << "StateMPAS::StateMPAS create." << std::endl;
   mpas_state_create_f90(keyState_, geom_->toFortran(), stateVars(), vars_);
+  touch();
   oops::Log::trace() << "StateMPAS::StateMPAS created." << std::endl;
 }
 // -----------------------------------------------------------------------------
@@ -51,6 +58,7 @@ StateMPAS::StateMPAS(const GeometryMPAS & resol,
   } else {
     mpas_state_read_file_f90(keyState_, config, time_);
   }
+  touch();
 
   oops::Log::trace() << "StateMPAS::StateMPAS created and read in."
                      << std::endl;
@@ -65,6 +73,7 @@ StateMPAS::StateMPAS(const GeometryMPAS & resol,
 
   mpas_state_create_f90(keyState_, geom_->toFortran(), stateVars(), vars_);
   mpas_state_change_resol_f90(keyState_, other.keyState_);
+  touch();
   oops::Log::trace() << "StateMPAS::StateMPAS created by interpolation."
                      << std::endl;
 }
@@ -74,21 +83,48 @@ StateMPAS::StateMPAS(const StateMPAS & other)
 {
   oops::Log::trace() << "StateMPAS::StateMPAS before copied." << std::endl;
 
-  mpas_state_create_f90(keyState_, geom_->toFortran(), stateVars(), vars_);
-  mpas_state_copy_f90(keyState_, other.keyState_);
+  mpas_state_clone_f90(keyState_, other.keyState_);
+  // identical contents, so derived quantities of other remain valid for the copy
+  stamp_ = other.stamp_;
   oops::Log::trace() << "StateMPAS::StateMPAS copied." << std::endl;
 }
 // -----------------------------------------------------------------------------
+StateMPAS::StateMPAS(StateMPAS && other)
+  : keyState_(other.keyState_), stamp_(other.stamp_), geom_(other.geom_),
+    vars_(other.vars_), time_(other.time_)
+{
+  other.keyState_ = 0;
+  oops::Log::trace() << "StateMPAS::StateMPAS moved." << std::endl;
+}
+// -----------------------------------------------------------------------------
 StateMPAS::~StateMPAS() {
-  mpas_state_delete_f90(keyState_);
+  if (keyState_ != 0) mpas_state_delete_f90(keyState_);
   oops::Log::trace() << "StateMPAS::StateMPAS destructed." << std::endl;
 }
 // -----------------------------------------------------------------------------
 /// Basic operators
 // -----------------------------------------------------------------------------
 StateMPAS & StateMPAS::operator=(const StateMPAS & rhs) {
-  mpas_state_copy_f90(keyState_, rhs.keyState_);
+  if (keyState_ == 0) {
+    // moved-from, so there are no fields to copy into
+    geom_ = rhs.geom_;
+    vars_ = rhs.vars_;
+    mpas_state_clone_f90(keyState_, rhs.keyState_);
+  } else {
+    mpas_state_copy_f90(keyState_, rhs.keyState_);
+  }
   time_ = rhs.time_;
+  stamp_ = rhs.stamp_;
+  return *this;
+}
+// -----------------------------------------------------------------------------
+StateMPAS & StateMPAS::operator=(StateMPAS && rhs) {
+  // rhs takes the old fields of this and releases them when it goes away
+  std::swap(keyState_, rhs.keyState_);
+  std::swap(geom_, rhs.geom_);
+  std::swap(vars_, rhs.vars_);
+  time_ = rhs.time_;
+  stamp_ = rhs.stamp_;
   return *this;
 }
 // -----------------------------------------------------------------------------
@@ -96,6 +132,7 @@ StateMPAS & StateMPAS::operator=(const StateMPAS & rhs) {
 // -----------------------------------------------------------------------------
 void StateMPAS::changeResolution(const StateMPAS & other) {
   mpas_state_change_resol_f90(keyState_, other.keyState_);
+  touch();
   oops::Log::trace() << "StateMPAS changed resolution" << std::endl;
 }
 // -----------------------------------------------------------------------------
@@ -104,9 +141,14 @@ void StateMPAS::changeResolution(const StateMPAS & other) {
 StateMPAS & StateMPAS::operator+=(const IncrementMPAS & dx) {
   oops::Log::trace() << "StateMPAS add increment starting" << std::endl;
   ASSERT(this->validTime() == dx.validTime());
-  // Interpolate increment to state resolution
-  IncrementMPAS dx_sr(*geom_, dx);
-  mpas_state_add_incr_f90(keyState_, dx_sr.toFortran());
+  if (geom_->isEqual(*dx.geometry())) {
+    mpas_state_add_incr_f90(keyState_, dx.toFortran());
+  } else {
+    // Interpolate increment to state resolution
+    IncrementMPAS dx_sr(*geom_, dx);
+    mpas_state_add_incr_f90(keyState_, dx_sr.toFortran());
+  }
+  touch();
   oops::Log::trace() << "StateMPAS add increment done" << std::endl;
   return *this;
 }
@@ -146,6 +188,7 @@ void StateMPAS::serialize(std::vector<double> & vect) const {
 void StateMPAS::deserialize(const std::vector<double> & vect, size_t & index) {
   // Deserialize the field
   mpas_state_deserialize_f90(keyState_, vect.size(), vect.data(), index);
+  touch();
 
   // Use magic value to validate deserialization
   ASSERT(vect.at(index) == SerializeCheckValue);
@@ -159,12 +202,14 @@ void StateMPAS::deserialize(const std::vector<double> & vect, size_t & index) {
 // -----------------------------------------------------------------------------
 void StateMPAS::read(const eckit::Configuration & config) {
   mpas_state_read_file_f90(keyState_, config, time_);
+  touch();
 }
 // -----------------------------------------------------------------------------
 void StateMPAS::analytic_init(const eckit::Configuration & config,
                               const GeometryMPAS & geom) {
   oops::Log::trace() << "StateMPAS analytic init starting" << std::endl;
   mpas_state_analytic_init_f90(keyState_, geom.toFortran(), config, time_);
+  touch();
   oops::Log::trace() << "StateMPAS analytic init done" << std::endl;
 }
 // -----------------------------------------------------------------------------
@@ -202,10 +247,12 @@ void StateMPAS::print(std::ostream & os) const {
 // -----------------------------------------------------------------------------
 void StateMPAS::zero() {
   mpas_state_zero_f90(keyState_);
+  touch();
 }
 // -----------------------------------------------------------------------------
 void StateMPAS::accumul(const double & zz, const StateMPAS & xx) {
   mpas_state_axpy_f90(keyState_, zz, xx.keyState_);
+  touch();
 }
 // -----------------------------------------------------------------------------
 double StateMPAS::norm() const {
@@ -214,6 +261,10 @@ double StateMPAS::norm() const {
   return zz;
 }
 // -----------------------------------------------------------------------------
+void StateMPAS::touch() {
+  stamp_ = ++lastStamp;
+}
+// -----------------------------------------------------------------------------
 
 oops::Variables StateMPAS::stateVars()
 {
@@ -58,10 +58,12 @@ class StateMPAS : public util::Printable,
   StateMPAS(const GeometryMPAS &, const eckit::Configuration &);
   StateMPAS(const GeometryMPAS &, const StateMPAS &);
   StateMPAS(const StateMPAS &);
+  StateMPAS(StateMPAS &&);
   ~StateMPAS();
 //  virtual ~StateMPAS();
 
   StateMPAS & operator=(const StateMPAS &);
+  StateMPAS & operator=(StateMPAS &&);
   void zero();
   void accumul(const double &, const StateMPAS &);
 
@@ -91,12 +93,17 @@ class StateMPAS : public util::Printable,
   const oops::Variables & variables() const {return vars_;}
   void updateTime(const util::Duration & dt) {time_ += dt;}
 
-  int & toFortran() {return keyState_;}
+/// Identifies the current contents; changes whenever the fields may have been modified
+  size_t contentStamp() const {return stamp_;}
+
+  int & toFortran() {touch(); return keyState_;}
   const int & toFortran() const {return keyState_;}
 
  private:
   void print(std::ostream &) const override;
-  F90state keyState_;
+  void touch();
+  F90state keyState_;  // 0 once the fields have been moved to another StateMPAS
+  size_t stamp_;
   std::shared_ptr<const GeometryMPAS> geom_;
   oops::Variables vars_;
   util::DateTime time_;
@@ -34,6 +34,7 @@ extern "C" {
   void mpas_state_create_f90(F90state &, const F90geom &,
                              const oops::Variables &,
                              const oops::Variables &);
+  void mpas_state_clone_f90(F90state &, const F90state &);
   void mpas_state_delete_f90(F90state &);
   void mpas_state_copy_f90(const F90state &, const F90state &);
   void mpas_state_zero_f90(const F90state &);
@@ -30,6 +30,10 @@ VarChaModel2GeoVars::VarChaModel2GeoVars(const GeometryMPAS & geom,
   util::Timer timer(classname(), "VarChaModel2GeoVars");
   oops::Log::trace() << classname() << " constructor starting" << std::endl;
   mpasjedi_vc_model2geovars_create_f90(keyFtnConfig_, geom_->toFortran(), config);
+  // All keys read by mpasjedi_vc_model2geovars_mod::create
+  configKey_ = "column block size: ";
+  configKey_ += config.has("column block size") ?
+                std::to_string(config.getInt("column block size")) : "default";
   oops::Log::trace() << classname() << " constructor done" << std::endl;
 }
 // -------------------------------------------------------------------------------------------------
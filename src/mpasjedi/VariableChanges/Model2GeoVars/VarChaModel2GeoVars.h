@@ -33,8 +33,12 @@ class VarChaModel2GeoVars : public oops::VariableChangeBase<MPASTraits>,
   void changeVar(const StateMPAS &, StateMPAS &) const override;
   void changeVarInverse(const StateMPAS &, StateMPAS &) const override;
 
+  /// Settings of the configuration that changeVar depends on, equal for equal settings
+  const std::string & configKey() const {return configKey_;}
+
  private:
   F90vc_M2G keyFtnConfig_;
+  std::string configKey_;
   std::shared_ptr<const GeometryMPAS> geom_;
   void print(std::ostream &) const override;
 };
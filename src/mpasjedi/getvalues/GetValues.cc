@@ -5,8 +5,12 @@
  * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
  */
 
+#include "oops/base/Variables.h"
+
 #include "mpasjedi/GeometryMPAS.h"
 #include "mpasjedi/getvalues/GetValues.h"
+#include "mpasjedi/getvalues/LocationPool.h"
+#include "mpasjedi/getvalues/Model2GeoVarsCache.h"
 #include "mpasjedi/StateMPAS.h"
 #include "mpasjedi/VariableChanges/Model2GeoVars/VarChaModel2GeoVars.h"
 
@@ -23,13 +27,20 @@ GetValues::GetValues(const GeometryMPAS & geom, const ufo::Locations & locs,
   {
   util::Timer timervc(classname(), "VarChaModel2GeoVars");
   model2geovars_.reset(new VarChaModel2GeoVars(*geom_, config));
+  model2geovarsCache_ = geom_->model2GeoVarsCache();
   }
 
   // Call GetValues consructor
   {
   util::Timer timergv(classname(), "GetValues");
 
-  mpas_getvalues_create_f90(keyGetValues_, geom_->toFortran(), locs_, config);
+  // Observation spaces on this geometry that opt in share their locations
+  F90locationpool keyPool = 0;
+  if (config.getBool("pooled interpolation", false)) {
+    locationPool_ = geom_->locationPool();
+    keyPool = locationPool_->toFortran();
+  }
+  mpas_getvalues_create_f90(keyGetValues_, geom_->toFortran(), locs_, config, keyPool);
   }
   oops::Log::trace() << "GetValues::GetValues done" << std::endl;
 }
@@ -49,7 +60,8 @@ GetValues::~GetValues() {
 *
 * \details **fillGeoVaLs()** Calls the fortran subroutine that will convert then
 * interpolate the state variable fields to the requested GeoVaLs variables then
-* locations, respectively. 
+* locations, respectively. Static geovars that were memoized by an earlier call
+* are copied from the memo, without a variable change or interpolation.
 *
 * \param[in] state reference to the input StateMPAS object
 * \param[in] t1 DateTime that is the beginning of the requested time window
@@ -62,28 +74,143 @@ void GetValues::fillGeoVaLs(const StateMPAS & state, const util::DateTime & t1,
                             ufo::GeoVaLs & geovals) const {
   oops::Log::trace() << "GetValues::fillGeoVaLs starting" << std::endl;
 
-  if (geovals.getVars() <= state.variables()) {
+  // Memoized static geovars
+  oops::Variables memoized;
+  {
+  util::Timer timerst(classname(), "fillStaticGeoVaLs");
+  mpas_getvalues_fill_static_geovals_f90(keyGetValues_, t1, t2, locs_,
+                                         geovals.toFortran(), memoized);
+  }
+
+  oops::Variables vars;
+  const oops::Variables & geovars = geovals.getVars();
+  for (size_t jvar = 0; jvar < geovars.size(); ++jvar) {
+    if (!memoized.has(geovars[jvar])) vars.push_back(geovars[jvar]);
+  }
+
+  if (vars.size() == 0) {
+    oops::Log::trace() << "GetValues::fillGeoVaLs done (memoized)" << std::endl;
+    return;
+  }
+
+  if (vars <= state.variables()) {
     util::Timer timergv(classname(), "fillGeoVaLs");
     mpas_getvalues_fill_geovals_f90(keyGetValues_, geom_->toFortran(),
-                                    state.toFortran(), t1, t2, locs_,
+                                    state.toFortran(), state.contentStamp(), t1, t2, locs_,
                                     geovals.toFortran());
   } else {
-    // Create state with geovals variables
-    StateMPAS geovars(*geom_, geovals.getVars(), state.validTime());
+    // States holding the geovals variables, shared with the other GetValues
+    Model2GeoVarsCache::Chunks chunks;
 
     {
     util::Timer timervc(classname(), "changeVar");
-    model2geovars_->changeVar(state, geovars);
+    chunks = model2geovarsCache_->get(state, vars, *model2geovars_);
     }
 
     // Fill GeoVaLs
-    mpas_getvalues_fill_geovals_f90(keyGetValues_, geom_->toFortran(),
-                                    geovars.toFortran(), t1, t2, locs_,
-                                    geovals.toFortran());
+    util::Timer timergv(classname(), "fillGeoVaLs");
+    for (const auto & chunk : chunks) {
+      mpas_getvalues_fill_geovals_f90(keyGetValues_, geom_->toFortran(),
+                                      chunk->toFortran(), chunk->contentStamp(), t1, t2, locs_,
+                                      geovals.toFortran());
+    }
   }
   oops::Log::trace() << "GetValues::fillGeoVaLs done" << std::endl;
 }
 
+// -----------------------------------------------------------------------------
+/*! \brief fill the GeoVaLs of several GetValues using a StateMPAS object
+*
+* \details **fillGeoVaLs()** Batch version of fillGeoVaLs for the GetValues of
+* several observation spaces on the same geometry. The memoized static geovars
+* are filled first, then the variable change is done once for the union of the
+* remaining geovars and all GeoVaLs are filled by one Fortran call per chunk, in
+* which the collective exchanges of all GetValues are done before their
+* interpolation kernels. The result is the same as calling fillGeoVaLs for each
+* GetValues in turn. The variable change is shared, so all GetValues of the
+* batch must have the same Model2GeoVars settings (see
+* VarChaModel2GeoVars::configKey).
+*
+* \param[in] getvalues the GetValues of the batch, all distinct
+* \param[in] state reference to the input StateMPAS object
+* \param[in] t1 DateTime that is the beginning of the requested time window
+* \param[in] t2 DateTime that is the end of the requested time window
+* \param[out] geovals the GeoVaLs objects that will be populated, one per GetValues
+*
+*/
+void GetValues::fillGeoVaLs(const std::vector<const GetValues *> & getvalues,
+                            const StateMPAS & state, const util::DateTime & t1,
+                            const util::DateTime & t2,
+                            const std::vector<ufo::GeoVaLs *> & geovals) {
+  oops::Log::trace() << "GetValues::fillGeoVaLs batch starting" << std::endl;
+  ASSERT(getvalues.size() == geovals.size());
+  if (getvalues.size() == 0) return;
+  const GetValues & first = *getvalues[0];
+  for (const GetValues * gv : getvalues) {
+    ASSERT(gv->geom_->toFortran() == first.geom_->toFortran());
+    ASSERT(gv->model2geovars_->configKey() == first.model2geovars_->configKey());
+  }
+
+  // Memoized static geovars, and union of the geovars that remain to be filled
+  std::vector<F90getvalues> keys;
+  std::vector<const ufo::Locations *> locs;
+  std::vector<F90goms> goms;
+  oops::Variables vars;
+  for (size_t jj = 0; jj < getvalues.size(); ++jj) {
+    const GetValues & gv = *getvalues[jj];
+    oops::Variables memoized;
+    {
+    util::Timer timerst(classname(), "fillStaticGeoVaLs");
+    mpas_getvalues_fill_static_geovals_f90(gv.keyGetValues_, t1, t2, gv.locs_,
+                                           geovals[jj]->toFortran(), memoized);
+    }
+    bool remaining = false;
+    const oops::Variables & geovars = geovals[jj]->getVars();
+    for (size_t jvar = 0; jvar < geovars.size(); ++jvar) {
+      if (memoized.has(geovars[jvar])) continue;
+      remaining = true;
+      if (!vars.has(geovars[jvar])) vars.push_back(geovars[jvar]);
+    }
+    if (remaining) {
+      keys.push_back(gv.keyGetValues_);
+      locs.push_back(&gv.locs_);
+      goms.push_back(geovals[jj]->toFortran());
+    }
+  }
+
+  if (keys.size() == 0) {
+    oops::Log::trace() << "GetValues::fillGeoVaLs batch done (memoized)" << std::endl;
+    return;
+  }
+
+  const int nbatch = keys.size();
+  if (vars <= state.variables()) {
+    util::Timer timergv(classname(), "fillGeoVaLsBatch");
+    std::vector<F90state> states(nbatch, state.toFortran());
+    mpas_getvalues_fill_geovals_batch_f90(nbatch, keys.data(), first.geom_->toFortran(),
+                                          states.data(), state.contentStamp(), t1, t2,
+                                          locs.data(), goms.data());
+  } else {
+    // States holding the geovals variables, shared with the other GetValues
+    Model2GeoVarsCache::Chunks chunks;
+
+    {
+    util::Timer timervc(classname(), "changeVar");
+    chunks = first.model2geovarsCache_->get(state, vars, *first.model2geovars_);
+    }
+
+    // Fill GeoVaLs
+    util::Timer timergv(classname(), "fillGeoVaLsBatch");
+    for (const auto & chunk : chunks) {
+      std::vector<F90state> states(nbatch, chunk->toFortran());
+      mpas_getvalues_fill_geovals_batch_f90(nbatch, keys.data(), first.geom_->toFortran(),
+                                            states.data(), chunk->contentStamp(), t1, t2,
+                                            locs.data(), goms.data());
+    }
+  }
+  oops::Log::trace() << "GetValues::fillGeoVaLs batch done" << std::endl;
+}
+
 // -----------------------------------------------------------------------------
 
 void GetValues::print(std::ostream & os) const {
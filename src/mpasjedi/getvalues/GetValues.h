@@ -39,6 +39,8 @@ namespace ufo {
 
 namespace mpas {
   class GeometryMPAS;
+  class LocationPool;
+  class Model2GeoVarsCache;
   class StateMPAS;
   class VarChaModel2GeoVars;
 
@@ -56,12 +58,19 @@ class GetValues : public util::Printable,
   void fillGeoVaLs(const StateMPAS &, const util::DateTime &,
             const util::DateTime &, ufo::GeoVaLs &) const;
 
+  /// Fills the GeoVaLs of several GetValues on the same geometry from one state
+  static void fillGeoVaLs(const std::vector<const GetValues *> &, const StateMPAS &,
+                          const util::DateTime &, const util::DateTime &,
+                          const std::vector<ufo::GeoVaLs *> &);
+
  private:
   void print(std::ostream &) const;
   F90getvalues keyGetValues_;
   ufo::Locations locs_;
   std::shared_ptr<const GeometryMPAS> geom_;
   std::unique_ptr<VarChaModel2GeoVars> model2geovars_;
+  std::shared_ptr<Model2GeoVarsCache> model2geovarsCache_;
+  std::shared_ptr<LocationPool> locationPool_;
 };
 
 // -------------------------------------------------------------------------------------------------
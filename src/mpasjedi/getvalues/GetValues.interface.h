@@ -7,12 +7,18 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "mpasjedi/Fortran.h"
 
 namespace eckit {
   class Configuration;
 }
 
+namespace oops {
+  class Variables;
+}
+
 namespace util {
   class DateTime;
 }
@@ -26,15 +32,28 @@ namespace mpas {
 extern "C" {
 
   void mpas_getvalues_create_f90(F90getvalues &, const F90geom &,
-    const ufo::Locations &, const eckit::Configuration &);
+    const ufo::Locations &, const eckit::Configuration &, const F90locationpool &);
 
   void mpas_getvalues_delete_f90(F90getvalues &);
 
   void mpas_getvalues_fill_geovals_f90(
-    const F90getvalues &, const F90geom &, const F90state &,
+    const F90getvalues &, const F90geom &, const F90state &, const size_t &,
     const util::DateTime &, const util::DateTime &,
     const ufo::Locations &, const F90goms &);
 
+  void mpas_getvalues_fill_static_geovals_f90(
+    const F90getvalues &, const util::DateTime &, const util::DateTime &,
+    const ufo::Locations &, const F90goms &, oops::Variables &);
+
+  void mpas_getvalues_fill_geovals_batch_f90(
+    const int &, const F90getvalues *, const F90geom &, const F90state *, const size_t &,
+    const util::DateTime &, const util::DateTime &,
+    const ufo::Locations * const *, const F90goms *);
+
+  void mpas_location_pool_create_f90(F90locationpool &);
+
+  void mpas_location_pool_delete_f90(F90locationpool &);
+
 };  // extern "C"
 
 // -------------------------------------------------------------------------------------------------
@@ -9,6 +9,7 @@
 
 #include "mpasjedi/GeometryMPAS.h"
 #include "mpasjedi/getvalues/LinearGetValues.h"
+#include "mpasjedi/getvalues/Model2GeoVarsCache.h"
 #include "mpasjedi/IncrementMPAS.h"
 #include "mpasjedi/StateMPAS.h"
 #include "mpasjedi/VariableChanges/Model2GeoVars/LinVarChaModel2GeoVars.h"
@@ -29,6 +30,7 @@ LinearGetValues::LinearGetValues(const GeometryMPAS & geom,
   {
   util::Timer timervc(classname(), "VarChaModel2GeoVars");
   model2geovars_.reset(new VarChaModel2GeoVars(*geom_, config));
+  model2geovarsCache_ = geom_->model2GeoVarsCache();
   }
 
   // Call GetValues consructor
@@ -84,9 +86,12 @@ void LinearGetValues::setTrajectory(const StateMPAS & state,
   ufo::GeoVaLs & geovals) {
   oops::Log::trace() << "LinearGetValues::setTrajectory starting" << std::endl;
 
-  // Create state with geovals variables
-  StateMPAS geovars(*geom_, geovals.getVars(), state.validTime());
-  model2geovars_->changeVar(state, geovars);
+  // States holding the geovals variables, shared with the other GetValues
+  Model2GeoVarsCache::Chunks geovars;
+  {
+  util::Timer timervc(classname(), "changeVar");
+  geovars = model2geovarsCache_->get(state, geovals.getVars(), *model2geovars_);
+  }
 
   // Create the linear variable change object
   {
@@ -102,9 +107,11 @@ void LinearGetValues::setTrajectory(const StateMPAS & state,
   {
   util::Timer timergv(classname(), "SetTrajectory");
 
-  mpas_lineargetvalues_set_trajectory_f90(
-    keyLinearGetValues_, geom_->toFortran(), geovars.toFortran(),
-    t1, t2, locs_, geovals.toFortran());
+  for (const auto & chunk : geovars) {
+    mpas_lineargetvalues_set_trajectory_f90(
+      keyLinearGetValues_, geom_->toFortran(), chunk->toFortran(),
+      t1, t2, locs_, geovals.toFortran());
+  }
   }
 
   oops::Log::trace() << "LinearGetValues::setTrajectory done" << std::endl;
@@ -166,6 +173,92 @@ void LinearGetValues::fillGeoVaLsAD(IncrementMPAS & inc,
 
 // -----------------------------------------------------------------------------
 
+void LinearGetValues::fillGeoVaLsTL(
+  const std::vector<const LinearGetValues *> & lineargetvalues,
+  const IncrementMPAS & inc, const util::DateTime & t1, const util::DateTime & t2,
+  const std::vector<ufo::GeoVaLs *> & geovals) {
+  oops::Log::trace() << "LinearGetValues::fillGeoVaLsTL batch starting" << std::endl;
+  ASSERT(lineargetvalues.size() == geovals.size());
+  if (lineargetvalues.size() == 0) return;
+
+  // Create increments with geovals variables
+  std::vector<std::unique_ptr<IncrementMPAS>> incgeovars;
+  std::vector<F90lineargetvalues> keys;
+  std::vector<F90inc> incs;
+  std::vector<const ufo::Locations *> locs;
+  std::vector<F90goms> goms;
+  for (size_t jj = 0; jj < lineargetvalues.size(); ++jj) {
+    const LinearGetValues & lgv = *lineargetvalues[jj];
+    incgeovars.emplace_back(new IncrementMPAS(*lgv.geom_, geovals[jj]->getVars(),
+                                              inc.validTime()));
+    {
+    util::Timer timervc(classname(), "multiply");
+    lgv.getLinVarCha(t1)->multiply(inc, *incgeovars.back());
+    }
+    keys.push_back(lgv.keyLinearGetValues_);
+    incs.push_back(incgeovars.back()->toFortran());
+    locs.push_back(&lgv.locs_);
+    goms.push_back(geovals[jj]->toFortran());
+  }
+
+  {
+  util::Timer timergv(classname(), "fillGeoVaLsTLBatch");
+  const int nbatch = keys.size();
+  mpas_lineargetvalues_fill_geovals_tl_batch_f90(
+    nbatch, keys.data(), lineargetvalues[0]->geom_->toFortran(), incs.data(),
+    t1, t2, locs.data(), goms.data());
+  }
+
+  oops::Log::trace() << "LinearGetValues::fillGeoVaLsTL batch done" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+void LinearGetValues::fillGeoVaLsAD(
+  const std::vector<const LinearGetValues *> & lineargetvalues,
+  const std::vector<IncrementMPAS *> & incs,
+  const util::DateTime & t1, const util::DateTime & t2,
+  const std::vector<const ufo::GeoVaLs *> & geovals) {
+  oops::Log::trace() << "LinearGetValues::fillGeoVaLsAD batch starting" << std::endl;
+  ASSERT(lineargetvalues.size() == geovals.size());
+  ASSERT(lineargetvalues.size() == incs.size());
+  if (lineargetvalues.size() == 0) return;
+
+  // Create increments with geovals variables
+  std::vector<std::unique_ptr<IncrementMPAS>> incgeovars;
+  std::vector<F90lineargetvalues> keys;
+  std::vector<F90inc> incgeokeys;
+  std::vector<const ufo::Locations *> locs;
+  std::vector<F90goms> goms;
+  for (size_t jj = 0; jj < lineargetvalues.size(); ++jj) {
+    const LinearGetValues & lgv = *lineargetvalues[jj];
+    incgeovars.emplace_back(new IncrementMPAS(*lgv.geom_, geovals[jj]->getVars(),
+                                              incs[jj]->validTime()));
+    keys.push_back(lgv.keyLinearGetValues_);
+    incgeokeys.push_back(incgeovars.back()->toFortran());
+    locs.push_back(&lgv.locs_);
+    goms.push_back(geovals[jj]->toFortran());
+  }
+
+  {
+  util::Timer timergv(classname(), "fillGeoVaLsADBatch");
+  const int nbatch = keys.size();
+  mpas_lineargetvalues_fill_geovals_ad_batch_f90(
+    nbatch, keys.data(), lineargetvalues[0]->geom_->toFortran(), incgeokeys.data(),
+    t1, t2, locs.data(), goms.data());
+  }
+
+  // Change variables
+  for (size_t jj = 0; jj < lineargetvalues.size(); ++jj) {
+    util::Timer timervc(classname(), "multiplyAD");
+    lineargetvalues[jj]->getLinVarCha(t1)->multiplyAD(*incgeovars[jj], *incs[jj]);
+  }
+
+  oops::Log::trace() << "LinearGetValues::fillGeoVaLsAD batch done" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
 void LinearGetValues::print(std::ostream & os) const {
   os << " LinearGetValues for mpas-jedi" << std::endl;
 }
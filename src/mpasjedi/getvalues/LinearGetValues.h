@@ -37,6 +37,7 @@ namespace ufo {
 namespace mpas {
   class GeometryMPAS;
   class IncrementMPAS;
+  class Model2GeoVarsCache;
   class StateMPAS;
   class VarChaModel2GeoVars;
   class LinVarChaModel2GeoVars;
@@ -60,6 +61,16 @@ class LinearGetValues : public util::Printable,
                      const util::DateTime & t2,
                      const ufo::GeoVaLs & geovals) const;
 
+  /// Batch versions of fillGeoVaLsTL/AD for LinearGetValues on the same geometry
+  static void fillGeoVaLsTL(const std::vector<const LinearGetValues *> & lineargetvalues,
+                            const IncrementMPAS & inc, const util::DateTime & t1,
+                            const util::DateTime & t2,
+                            const std::vector<ufo::GeoVaLs *> & geovals);
+  static void fillGeoVaLsAD(const std::vector<const LinearGetValues *> & lineargetvalues,
+                            const std::vector<IncrementMPAS *> & incs,
+                            const util::DateTime & t1, const util::DateTime & t2,
+                            const std::vector<const ufo::GeoVaLs *> & geovals);
+
  private:
   const LinVarChaModel2GeoVars * getLinVarCha(const util::DateTime &) const;
 
@@ -72,6 +83,7 @@ class LinearGetValues : public util::Printable,
   std::shared_ptr<const GeometryMPAS> geom_;
   std::map< util::DateTime, LinVarChaModel2GeoVars * > linearmodel2geovars_;
   std::unique_ptr<VarChaModel2GeoVars> model2geovars_;
+  std::shared_ptr<Model2GeoVarsCache> model2geovarsCache_;
 };
 
 // -----------------------------------------------------------------------------
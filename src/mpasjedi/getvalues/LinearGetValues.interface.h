@@ -46,6 +46,16 @@ extern "C" {
     const util::DateTime &, const util::DateTime &, const ufo::Locations &,
     const F90goms &);
 
+  void mpas_lineargetvalues_fill_geovals_tl_batch_f90(
+    const int &, const F90lineargetvalues *, const F90geom &, const F90inc *,
+    const util::DateTime &, const util::DateTime &, const ufo::Locations * const *,
+    const F90goms *);
+
+  void mpas_lineargetvalues_fill_geovals_ad_batch_f90(
+    const int &, const F90lineargetvalues *, const F90geom &, const F90inc *,
+    const util::DateTime &, const util::DateTime &, const ufo::Locations * const *,
+    const F90goms *);
+
 };  // extern "C"
 
 // -------------------------------------------------------------------------------------------------
@@ -0,0 +1,37 @@
+/*
+ * (C) Copyright 2020 UCAR
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#include "oops/util/Logger.h"
+
+#include "mpasjedi/getvalues/GetValues.interface.h"
+#include "mpasjedi/getvalues/LocationPool.h"
+
+namespace mpas {
+
+// -------------------------------------------------------------------------------------------------
+
+LocationPool::LocationPool() {
+  mpas_location_pool_create_f90(keyPool_);
+  oops::Log::trace() << classname() << " constructed" << std::endl;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+LocationPool::~LocationPool() {
+  mpas_location_pool_delete_f90(keyPool_);
+  oops::Log::trace() << classname() << " destructed" << std::endl;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void LocationPool::print(std::ostream & os) const {
+  os << " LocationPool for mpas-jedi" << std::endl;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+}  // namespace mpas
@@ -0,0 +1,49 @@
+/*
+ * (C) Copyright 2020 UCAR
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#pragma once
+
+#include <ostream>
+#include <string>
+
+#include "oops/util/ObjectCounter.h"
+#include "oops/util/Printable.h"
+
+#include "mpasjedi/Fortran.h"
+
+namespace mpas {
+
+// -------------------------------------------------------------------------------------------------
+/// Union of the observation locations of the GetValues on one geometry
+/*!
+ * GetValues configured with "pooled interpolation: true" add their locations to
+ * the pool of their geometry instead of building their own interpolation engine.
+ * Duplicate locations are stored once, the pool interpolates each geovar once
+ * for all of them and every GetValues copies its values out of the pool (see
+ * mpasjedi_location_pool_mod).
+ */
+
+class LocationPool : public util::Printable,
+                     private util::ObjectCounter<LocationPool> {
+ public:
+  static const std::string classname() {return "mpas::LocationPool";}
+
+  LocationPool();
+  ~LocationPool();
+
+  const F90locationpool & toFortran() const {return keyPool_;}
+
+ private:
+  LocationPool(const LocationPool &);
+  LocationPool & operator=(const LocationPool &);
+  void print(std::ostream &) const;
+  F90locationpool keyPool_;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+}  // namespace mpas
@@ -0,0 +1,110 @@
+/*
+ * (C) Copyright 2020 UCAR
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#include "oops/util/Logger.h"
+#include "oops/util/Timer.h"
+
+#include "mpasjedi/GeometryMPAS.h"
+#include "mpasjedi/getvalues/Model2GeoVarsCache.h"
+#include "mpasjedi/StateMPAS.h"
+#include "mpasjedi/VariableChanges/Model2GeoVars/VarChaModel2GeoVars.h"
+
+namespace mpas {
+
+// -------------------------------------------------------------------------------------------------
+
+Model2GeoVarsCache::Model2GeoVarsCache(const size_t capacity)
+  : capacity_(capacity), entries_(), hits_(0), misses_(0) {
+  oops::Log::trace() << classname() << " constructed" << std::endl;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+Model2GeoVarsCache::~Model2GeoVarsCache() {
+  oops::Log::trace() << classname() << " destructed, hits = " << hits_
+                     << ", misses = " << misses_ << std::endl;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+Model2GeoVarsCache::Chunks Model2GeoVarsCache::get(const StateMPAS & state,
+                                                   const oops::Variables & vars,
+                                                   const VarChaModel2GeoVars & model2geovars) {
+  util::Timer timer(classname(), "get");
+
+  // Find the entry of this state, dropping entries of older contents of the same state
+  std::list<Entry>::iterator jentry = entries_.end();
+  for (std::list<Entry>::iterator jj = entries_.begin(); jj != entries_.end(); ) {
+    if (jj->stateKey == state.toFortran() && jj->stamp != state.contentStamp()) {
+      jj = entries_.erase(jj);
+    } else {
+      if (jj->stamp == state.contentStamp() && jj->time == state.validTime() &&
+          jj->configKey == model2geovars.configKey()) jentry = jj;
+      ++jj;
+    }
+  }
+
+  if (jentry == entries_.end()) {
+    Entry entry;
+    entry.stateKey = state.toFortran();
+    entry.stamp = state.contentStamp();
+    entry.time = state.validTime();
+    entry.configKey = model2geovars.configKey();
+    entries_.push_front(entry);
+    while (entries_.size() > capacity_) entries_.pop_back();
+  } else {
+    entries_.splice(entries_.begin(), entries_, jentry);
+  }
+  Entry & entry = entries_.front();
+
+  // Compute the geovars that are not available yet
+  oops::Variables missing;
+  for (size_t jvar = 0; jvar < vars.size(); ++jvar) {
+    if (!entry.vars.has(vars[jvar])) missing.push_back(vars[jvar]);
+  }
+  if (missing.size() > 0) {
+    ++misses_;
+    std::shared_ptr<StateMPAS> chunk(new StateMPAS(*state.geometry(), missing,
+                                                   state.validTime()));
+    model2geovars.changeVar(state, *chunk);
+    entry.chunks.push_back(chunk);
+    entry.vars += missing;
+    oops::Log::debug() << classname() << "::get computed " << missing << std::endl;
+  } else {
+    ++hits_;
+  }
+
+  // Only the chunks that hold some of vars are needed
+  Chunks chunks;
+  for (const auto & chunk : entry.chunks) {
+    const oops::Variables & chunkvars = chunk->variables();
+    for (size_t jvar = 0; jvar < chunkvars.size(); ++jvar) {
+      if (vars.has(chunkvars[jvar])) {
+        chunks.push_back(chunk);
+        break;
+      }
+    }
+  }
+  return chunks;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void Model2GeoVarsCache::clear() {
+  entries_.clear();
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void Model2GeoVarsCache::print(std::ostream & os) const {
+  os << classname() << ": " << entries_.size() << " entries, capacity = " << capacity_
+     << ", hits = " << hits_ << ", misses = " << misses_;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+}  // namespace mpas
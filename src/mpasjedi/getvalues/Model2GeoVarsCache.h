@@ -0,0 +1,80 @@
+/*
+ * (C) Copyright 2020 UCAR
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "oops/base/Variables.h"
+#include "oops/util/DateTime.h"
+#include "oops/util/ObjectCounter.h"
+#include "oops/util/Printable.h"
+
+namespace mpas {
+  class StateMPAS;
+  class VarChaModel2GeoVars;
+
+// -------------------------------------------------------------------------------------------------
+/// Model2GeoVars results shared by all GetValues and LinearGetValues on one geometry
+/*!
+ * Derived geovars depend only on the model state, so every GetValues of an
+ * observation space that needs e.g. virtual temperature or the CRTM surface
+ * classification of the same state can share them. Entries are keyed by the
+ * content stamp of the state (see StateMPAS::contentStamp), its valid time and
+ * the configuration of the VarChaModel2GeoVars that computes them (see
+ * VarChaModel2GeoVars::configKey), so users with different Model2GeoVars
+ * settings never see each other's results. Entries hold one or more StateMPAS
+ * "chunks" with the geovars computed so far; each
+ * geovar is computed once, when it is first requested. An entry is dropped as
+ * soon as the state it was computed from is seen with a new stamp, and the
+ * least recently used entries are evicted beyond capacity.
+ */
+
+class Model2GeoVarsCache : public util::Printable,
+                           private util::ObjectCounter<Model2GeoVarsCache> {
+ public:
+  static const std::string classname() {return "mpas::Model2GeoVarsCache";}
+
+  typedef std::vector<std::shared_ptr<const StateMPAS>> Chunks;
+
+  explicit Model2GeoVarsCache(const size_t capacity = defaultCapacity);
+  ~Model2GeoVarsCache();
+
+  /// States that together hold all of vars for state, computing only the missing geovars
+  Chunks get(const StateMPAS & state, const oops::Variables & vars,
+             const VarChaModel2GeoVars & model2geovars);
+
+  /// Drops all entries
+  void clear();
+
+  static const size_t defaultCapacity = 2;
+
+ private:
+  struct Entry {
+    int stateKey;
+    size_t stamp;
+    util::DateTime time;
+    std::string configKey;
+    oops::Variables vars;
+    Chunks chunks;
+  };
+
+  void print(std::ostream &) const;
+
+  const size_t capacity_;
+  std::list<Entry> entries_;  // most recently used first
+  size_t hits_;
+  size_t misses_;
+};
+
+// -------------------------------------------------------------------------------------------------
+
+}  // namespace mpas
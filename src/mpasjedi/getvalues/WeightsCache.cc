@@ -0,0 +1,103 @@
+/*
+ * (C) Copyright 2020 UCAR
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <climits>
+#include <cstdio>
+
+#include "eckit/filesystem/PathName.h"
+
+#include "oops/util/Logger.h"
+
+#include "mpasjedi/getvalues/WeightsCache.h"
+
+namespace mpas {
+
+// -------------------------------------------------------------------------------------------------
+
+uint64_t mpasjedi_weights_cache_hash(const void * data, size_t nbytes, uint64_t seed) {
+  const uint64_t prime = 1099511628211ULL;
+  uint64_t hash = (seed == 0) ? 14695981039346656037ULL : seed;
+  const unsigned char * bytes = static_cast<const unsigned char *>(data);
+  for (size_t jj = 0; jj < nbytes; ++jj) {
+    hash ^= bytes[jj];
+    hash *= prime;
+  }
+  return hash;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void * mpasjedi_weights_cache_map(const char * path, size_t * nbytes) {
+  *nbytes = 0;
+  const int fd = ::open(path, O_RDONLY);
+  if (fd < 0) return nullptr;
+
+  struct stat st;
+  if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+    ::close(fd);
+    return nullptr;
+  }
+
+  void * base = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (base == MAP_FAILED) {
+    oops::Log::warning() << "mpasjedi_weights_cache_map: could not map " << path << std::endl;
+    return nullptr;
+  }
+  *nbytes = static_cast<size_t>(st.st_size);
+  return base;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void mpasjedi_weights_cache_unmap(void * base, size_t nbytes) {
+  if (base != nullptr && nbytes > 0) ::munmap(base, nbytes);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool mpasjedi_weights_cache_mkdir(const char * dir) {
+  try {
+    eckit::PathName(dir).mkdir();
+  } catch (...) {
+    oops::Log::warning() << "mpasjedi_weights_cache_mkdir: could not create " << dir << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool mpasjedi_weights_cache_tmppath(const char * path, char * tmppath, size_t len) {
+  char host[HOST_NAME_MAX + 1] = "localhost";
+  if (::gethostname(host, sizeof(host)) != 0) host[0] = '\0';
+  host[HOST_NAME_MAX] = '\0';
+  const int nn = std::snprintf(tmppath, len, "%s.%s.%ld.tmp", path, host,
+                               static_cast<long>(::getpid()));
+  return nn > 0 && static_cast<size_t>(nn) < len;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+bool mpasjedi_weights_cache_commit(const char * tmppath, const char * path) {
+  if (std::rename(tmppath, path) != 0) {
+    oops::Log::warning() << "mpasjedi_weights_cache_commit: could not rename " << tmppath
+                         << " to " << path << std::endl;
+    std::remove(tmppath);
+    return false;
+  }
+  return true;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+}  // namespace mpas
@@ -0,0 +1,45 @@
+/*
+ * (C) Copyright 2020 UCAR
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace mpas {
+
+// -------------------------------------------------------------------------------------------------
+/// Low-level helpers for the on-disk GetValues interpolation weight cache.
+/// The file layout is owned by mpasjedi_interp_engine_mod; these functions only
+/// provide hashing, memory mapping and atomic publication of the cache files.
+
+extern "C" {
+
+  /// FNV-1a hash of nbytes bytes at data, continuing from seed (use 0 to start).
+  uint64_t mpasjedi_weights_cache_hash(const void * data, size_t nbytes, uint64_t seed);
+
+  /// Maps path read-only; returns nullptr (and nbytes = 0) if it cannot be mapped.
+  void * mpasjedi_weights_cache_map(const char * path, size_t * nbytes);
+
+  /// Releases a mapping obtained from mpasjedi_weights_cache_map.
+  void mpasjedi_weights_cache_unmap(void * base, size_t nbytes);
+
+  /// Creates directory dir (and its parents) if needed; returns false on failure.
+  bool mpasjedi_weights_cache_mkdir(const char * dir);
+
+  /// Writes to tmppath (of capacity len) a temporary name for path that is unique to this
+  /// host and process: <path>.<hostname>.<pid>.tmp; returns false if it does not fit.
+  bool mpasjedi_weights_cache_tmppath(const char * path, char * tmppath, size_t len);
+
+  /// Atomically renames a fully written temporary file into place.
+  bool mpasjedi_weights_cache_commit(const char * tmppath, const char * path);
+
+};  // extern "C"
+
+// -------------------------------------------------------------------------------------------------
+
+}  // namespace mpas
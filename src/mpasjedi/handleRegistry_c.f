@@ -0,0 +1,106 @@
+! (C) Copyright 2020 UCAR
+!
+! This software is licensed under the terms of the Apache Licence Version 2.0
+! which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+
+! Implementation of the handle registry declared in handleRegistry_i.f
+
+! ------------------------------------------------------------------------------
+
+!> Prepares an empty registry; does nothing if it is ready already
+subroutine registry_init(self)
+  implicit none
+  class(registry_t), intent(inout) :: self
+
+  if (self%initialized) return
+  allocate(self%slots(64), self%free(64))
+  self%count = 0
+  self%nfree = 0
+  self%initialized = .true.
+
+end subroutine registry_init
+
+! ------------------------------------------------------------------------------
+
+!> Allocates a new object and returns its key
+subroutine registry_add(self, key)
+  implicit none
+  class(registry_t), intent(inout) :: self
+  integer,           intent(inout) :: key
+
+  integer :: islot, maxgen
+  type(registry_slot_t), allocatable :: tmp(:)
+  integer, allocatable :: itmp(:)
+
+  if (.not. self%initialized) call self%init()
+
+  if (self%nfree > 0) then
+    islot = self%free(self%nfree)
+    self%nfree = self%nfree - 1
+  else
+    if (self%count == size(self%slots)) then
+      if (2*self%count >= 2**registry_slot_bits) &
+        call abor1_ftn('registry_add: too many live objects')
+      allocate(tmp(2*self%count), itmp(2*self%count))
+      tmp(1:self%count) = self%slots(1:self%count)
+      call move_alloc(tmp, self%slots)
+      call move_alloc(itmp, self%free)
+    end if
+    self%count = self%count + 1
+    islot = self%count
+  end if
+
+  allocate(self%slots(islot)%obj)
+  maxgen = 2**(bit_size(key) - 1 - registry_slot_bits) - 1
+  self%slots(islot)%generation = mod(self%slots(islot)%generation, maxgen) + 1
+  key = ior(ishft(self%slots(islot)%generation, registry_slot_bits), islot)
+
+end subroutine registry_add
+
+! ------------------------------------------------------------------------------
+
+!> Pointer to the object of key; aborts if the key is not live
+subroutine registry_get(self, key, ptr)
+  implicit none
+  class(registry_t),          intent(in)  :: self
+  integer,                    intent(in)  :: key
+  type(LISTED_TYPE), pointer, intent(out) :: ptr
+
+  ptr => self%slots(registry_slot(self, key))%obj
+
+end subroutine registry_get
+
+! ------------------------------------------------------------------------------
+
+!> Deallocates the object of key and releases its slot
+subroutine registry_remove(self, key)
+  implicit none
+  class(registry_t), intent(inout) :: self
+  integer,           intent(in)    :: key
+
+  integer :: islot
+
+  islot = registry_slot(self, key)
+  deallocate(self%slots(islot)%obj)
+  self%nfree = self%nfree + 1
+  self%free(self%nfree) = islot
+
+end subroutine registry_remove
+
+! ------------------------------------------------------------------------------
+
+!> Slot of a live key
+integer function registry_slot(self, key) result(islot)
+  implicit none
+  class(registry_t), intent(in) :: self
+  integer,           intent(in) :: key
+
+  islot = iand(key, 2**registry_slot_bits - 1)
+  if (.not. self%initialized .or. islot < 1 .or. islot > self%count) then
+    call abor1_ftn('registry_get: invalid key')
+  else if (.not. associated(self%slots(islot)%obj) .or. &
+           ishft(key, -registry_slot_bits) /= self%slots(islot)%generation) then
+    call abor1_ftn('registry_get: key of a deleted object')
+  end if
+
+end function registry_slot
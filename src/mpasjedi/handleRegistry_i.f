@@ -0,0 +1,38 @@
+! (C) Copyright 2020 UCAR
+!
+! This software is licensed under the terms of the Apache Licence Version 2.0
+! which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+
+! Handle registry of LISTED_TYPE objects, a drop-in replacement for the registry_t
+! of oops/util/linkedList_i.f with constant-time lookup. Include it in the
+! specification part of a module after defining LISTED_TYPE, and include
+! handleRegistry_c.f after 'contains'.
+!
+! The objects live in an indexed array of slots. A key encodes the slot and the
+! generation of the slot when the key was issued; removing an object frees its
+! slot for reuse under the next generation, so a stale key is detected instead
+! of silently resolving to the newer object. Each object is allocated on its
+! own, so the pointers returned by get stay valid while the slot array grows.
+
+!> Bits of a key that hold the slot index; the bits above hold the generation
+integer, parameter :: registry_slot_bits = 20
+
+!> One slot of the registry: the object and the generation of its key
+type :: registry_slot_t
+  type(LISTED_TYPE), pointer :: obj => null()
+  integer :: generation = 0
+end type registry_slot_t
+
+!> Registry of LISTED_TYPE objects keyed by handle
+type :: registry_t
+  logical :: initialized = .false.
+  integer :: count = 0   !< slots used so far
+  integer :: nfree = 0   !< slots released and available for reuse
+  type(registry_slot_t), allocatable :: slots(:)
+  integer, allocatable :: free(:)
+contains
+  procedure :: init => registry_init
+  procedure :: add => registry_add
+  procedure :: get => registry_get
+  procedure :: remove => registry_remove
+end type registry_t
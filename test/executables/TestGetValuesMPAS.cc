@@ -0,0 +1,190 @@
+/*
+ * (C) Copyright 2020 UCAR
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "eckit/config/LocalConfiguration.h"
+#include "eckit/mpi/Comm.h"
+#include "eckit/testing/Test.h"
+
+#include "oops/base/Variables.h"
+#include "oops/runs/Run.h"
+#include "oops/runs/Test.h"
+#include "oops/util/DateTime.h"
+#include "test/TestEnvironment.h"
+
+#include "ufo/GeoVaLs.h"
+#include "ufo/Locations.h"
+
+#include "mpasjedi/GeometryMPAS.h"
+#include "mpasjedi/getvalues/GetValues.h"
+#include "mpasjedi/StateMPAS.h"
+
+namespace mpas {
+namespace test {
+
+/// Tests of mpas::GetValues behaviour that the oops GetValues interface tests do not cover
+/*!
+ *  They read the same yaml file as test::GetValues: the geometry, locations,
+ *  state variables and GetValues settings at the top level, and the state from
+ *  "getvalues test.state generate". The optional "getvalues mpas test" section
+ *  may replace the state ("state") and the geovals variables ("geovals
+ *  variables"), and lists the GetValues settings to compare with ("references",
+ *  each with a "tolerance"); by default the geovals are compared with those of
+ *  plain unstructured interpolation.
+ */
+
+const eckit::Configuration & config() {return ::test::TestEnvironment::config();}
+
+/// The "getvalues mpas test" section, empty if there is none
+eckit::LocalConfiguration testConfig() {
+  if (config().has("getvalues mpas test")) {
+    return eckit::LocalConfiguration(config(), "getvalues mpas test");
+  }
+  return eckit::LocalConfiguration();
+}
+
+/// Configuration of the state, which the test section may replace
+eckit::LocalConfiguration stateConfig() {
+  if (testConfig().has("state")) return eckit::LocalConfiguration(testConfig(), "state");
+  return eckit::LocalConfiguration(eckit::LocalConfiguration(config(), "getvalues test"),
+                                   "state generate");
+}
+
+/// Geovals variables, which the test section may replace
+oops::Variables geovalsVariables() {
+  if (testConfig().has("geovals variables")) {
+    return oops::Variables(testConfig(), "geovals variables");
+  }
+  return oops::Variables(config(), "state variables");
+}
+
+/// Geometry, locations, window and state shared by the tests
+class GetValuesSetup {
+ public:
+  GetValuesSetup()
+    : geom_(eckit::LocalConfiguration(config(), "geometry"), eckit::mpi::comm()),
+      locsConfig_(config(), "locations"),
+      locs_(locsConfig_, eckit::mpi::comm()),
+      t1_(locsConfig_.getString("window begin")),
+      t2_(locsConfig_.getString("window end")),
+      vars_(geovalsVariables()),
+      state_(geom_, stateConfig()) {}
+
+  const GeometryMPAS & geometry() const {return geom_;}
+  const ufo::Locations & locations() const {return locs_;}
+  const util::DateTime & t1() const {return t1_;}
+  const util::DateTime & t2() const {return t2_;}
+  const oops::Variables & variables() const {return vars_;}
+  const StateMPAS & state() const {return state_;}
+
+ private:
+  const GeometryMPAS geom_;
+  const eckit::LocalConfiguration locsConfig_;
+  const ufo::Locations locs_;
+  const util::DateTime t1_;
+  const util::DateTime t2_;
+  const oops::Variables vars_;
+  const StateMPAS state_;
+};
+
+/// RMS of the difference between two GeoVaLs, relative to the RMS of ref
+double relativeDiff(const ufo::GeoVaLs & gv, const ufo::GeoVaLs & ref) {
+  ufo::GeoVaLs diff(gv);
+  diff -= ref;
+  return diff.rms() / std::max(ref.rms(), 1.0e-300);
+}
+
+// -----------------------------------------------------------------------------
+
+void testGetValuesReferences() {
+  const GetValuesSetup setup;
+
+  const GetValues gv(setup.geometry(), setup.locations(), config());
+  ufo::GeoVaLs geovals(setup.locations(), setup.variables());
+  gv.fillGeoVaLs(setup.state(), setup.t1(), setup.t2(), geovals);
+
+  std::vector<eckit::LocalConfiguration> references;
+  testConfig().get("references", references);
+  if (references.empty()) {
+    eckit::LocalConfiguration unstructured;
+    unstructured.set("interpolation type", std::string("unstructured"));
+    unstructured.set("tolerance", 1.0e-12);
+    references.push_back(unstructured);
+  }
+
+  for (const eckit::LocalConfiguration & refConfig : references) {
+    const GetValues refgv(setup.geometry(), setup.locations(), refConfig);
+    ufo::GeoVaLs ref(setup.locations(), setup.variables());
+    refgv.fillGeoVaLs(setup.state(), setup.t1(), setup.t2(), ref);
+    EXPECT(relativeDiff(geovals, ref) <= refConfig.getDouble("tolerance"));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void testGetValuesBatch() {
+  const GetValuesSetup setup;
+  const double tol = 1.0e-12;
+
+  // two observation spaces on the same locations, filled one after the other
+  const GetValues gv1(setup.geometry(), setup.locations(), config());
+  const GetValues gv2(setup.geometry(), setup.locations(), config());
+  ufo::GeoVaLs ref1(setup.locations(), setup.variables());
+  ufo::GeoVaLs ref2(setup.locations(), setup.variables());
+  gv1.fillGeoVaLs(setup.state(), setup.t1(), setup.t2(), ref1);
+  gv2.fillGeoVaLs(setup.state(), setup.t1(), setup.t2(), ref2);
+
+  // and as a batch
+  ufo::GeoVaLs geovals1(setup.locations(), setup.variables());
+  ufo::GeoVaLs geovals2(setup.locations(), setup.variables());
+  GetValues::fillGeoVaLs({&gv1, &gv2}, setup.state(), setup.t1(), setup.t2(),
+                         {&geovals1, &geovals2});
+  EXPECT(relativeDiff(geovals1, ref1) <= tol);
+  EXPECT(relativeDiff(geovals2, ref2) <= tol);
+
+  // a batch of one is the plain fill
+  ufo::GeoVaLs geovals3(setup.locations(), setup.variables());
+  GetValues::fillGeoVaLs({&gv1}, setup.state(), setup.t1(), setup.t2(), {&geovals3});
+  EXPECT(relativeDiff(geovals3, ref1) <= tol);
+}
+
+// -----------------------------------------------------------------------------
+
+class GetValuesMPAS : public oops::Test {
+ public:
+  GetValuesMPAS() {}
+  virtual ~GetValuesMPAS() {}
+
+ private:
+  std::string testid() const override {return "mpas::test::GetValuesMPAS";}
+
+  void register_tests() const override {
+    std::vector<eckit::testing::Test>& ts = eckit::testing::specification();
+
+    ts.emplace_back(CASE("mpasjedi/GetValues/testGetValuesReferences")
+      { testGetValuesReferences(); });
+    ts.emplace_back(CASE("mpasjedi/GetValues/testGetValuesBatch")
+      { testGetValuesBatch(); });
+  }
+
+  void clear() const override {}
+};
+
+// -----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace mpas
+
+int main(int argc,  char ** argv) {
+  oops::Run run(argc, argv);
+  mpas::test::GetValuesMPAS tests;
+  return run.execute(tests);
+}
@@ -0,0 +1,341 @@
+/*
+ * (C) Copyright 2020 UCAR
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "eckit/config/LocalConfiguration.h"
+#include "eckit/testing/Test.h"
+
+#include "oops/runs/Run.h"
+#include "oops/runs/Test.h"
+#include "oops/test/interface/Increment.h"
+#include "oops/util/DateTime.h"
+#include "test/TestEnvironment.h"
+
+#include "mpasjedi/Fortran.h"
+#include "mpasjedi/GeometryMPAS.h"
+#include "mpasjedi/IncrementMPAS.h"
+#include "mpasjedi/MPASTraits.h"
+
+namespace mpas {
+namespace test {
+
+/// Tests of IncrementMPAS behaviour that the oops Increment interface tests do not cover
+/*!
+ *  They use the geometry, variables and date of the oops Increment test
+ *  fixture, so they run on the same yaml file as test::Increment.
+ */
+
+typedef ::test::IncrementFixture<MPASTraits> Fixture;
+
+const GeometryMPAS & geometry() {return Fixture::resol().geometry();}
+
+/// Number of field pool requests of the geometry that were served by recycled pools
+std::size_t fieldPoolHits() {
+  std::size_t nrequests, nhits, nreleases, nkept;
+  mpas_geo_field_pool_stats_f90(geometry().toFortran(), nrequests, nhits, nreleases,
+                                nkept);
+  return nhits;
+}
+
+/// Copies the values of from into to, which may be stored differently
+void copyValues(const IncrementMPAS & from, IncrementMPAS & to) {
+  std::vector<double> values;
+  from.serialize(values);
+  std::size_t index = 0;
+  to.deserialize(values, index);
+}
+
+/// Largest difference between the values of two increments, relative to the largest value of ref
+double relativeDiff(const IncrementMPAS & dx, const IncrementMPAS & ref) {
+  std::vector<double> values, refValues;
+  dx.serialize(values);
+  ref.serialize(refValues);
+  EXPECT(values.size() == refValues.size());
+  double diff = 0.0;
+  double scale = 0.0;
+  for (std::size_t jj = 0; jj < values.size(); ++jj) {
+    diff = std::max(diff, std::abs(values[jj] - refValues[jj]));
+    scale = std::max(scale, std::abs(refValues[jj]));
+  }
+  return diff / std::max(scale, 1.0e-300);
+}
+
+// -----------------------------------------------------------------------------
+
+void testIncrementMoveConstructor() {
+  IncrementMPAS dx1(geometry(), Fixture::ctlvars(), Fixture::time());
+  dx1.random();
+  const double norm = dx1.norm();
+  const int key = dx1.toFortran();
+
+  IncrementMPAS dx2(std::move(dx1));
+  EXPECT(dx2.toFortran() == key);
+  EXPECT(dx1.toFortran() == 0);
+  EXPECT(dx2.norm() == norm);
+}
+
+// -----------------------------------------------------------------------------
+
+void testIncrementMoveAssignment() {
+  IncrementMPAS dx1(geometry(), Fixture::ctlvars(), Fixture::time());
+  IncrementMPAS dx2(geometry(), Fixture::ctlvars(), Fixture::time());
+  dx1.random();
+  const double norm = dx1.norm();
+  const int key = dx1.toFortran();
+
+  dx2 = std::move(dx1);
+  EXPECT(dx2.toFortran() == key);
+  EXPECT(dx2.norm() == norm);
+  // dx1 holds the old fields of dx2 until it is destroyed
+  EXPECT(dx1.toFortran() != 0);
+  EXPECT(dx1.norm() == 0.0);
+}
+
+// -----------------------------------------------------------------------------
+
+void testIncrementCopyIntoMovedFrom() {
+  IncrementMPAS dx1(geometry(), Fixture::ctlvars(), Fixture::time());
+  dx1.random();
+  IncrementMPAS dx2(std::move(dx1));
+  const double norm = dx2.norm();
+
+  dx1 = dx2;
+  EXPECT(dx1.toFortran() != 0);
+  EXPECT(dx1.toFortran() != dx2.toFortran());
+  EXPECT(dx1.norm() == norm);
+
+  // the copy has its own fields
+  dx1.zero();
+  EXPECT(dx2.norm() == norm);
+}
+
+// -----------------------------------------------------------------------------
+
+void testIncrementDestroyMovedFrom() {
+  std::unique_ptr<IncrementMPAS> dx1(
+    new IncrementMPAS(geometry(), Fixture::ctlvars(), Fixture::time()));
+  dx1->random();
+  const double norm = dx1->norm();
+
+  IncrementMPAS dx2(std::move(*dx1));
+  dx1.reset();
+  EXPECT(dx2.norm() == norm);
+
+  // a new increment does not get the fields of dx2
+  IncrementMPAS dx3(geometry(), Fixture::ctlvars(), Fixture::time());
+  EXPECT(dx3.toFortran() != dx2.toFortran());
+  EXPECT(dx2.norm() == norm);
+}
+
+// -----------------------------------------------------------------------------
+
+void testIncrementFieldPoolReuse() {
+  IncrementMPAS dx1(geometry(), Fixture::ctlvars(), Fixture::time());
+  dx1.random();
+  const double norm = dx1.norm();
+  {
+    IncrementMPAS dx2(dx1);
+    dx2 *= 2.0;
+  }
+
+  // dx3 takes over the fields released by dx2
+  const std::size_t nhits = fieldPoolHits();
+  IncrementMPAS dx3(geometry(), Fixture::ctlvars(), Fixture::time());
+  EXPECT(fieldPoolHits() == nhits + 1);
+  EXPECT(dx3.norm() == 0.0);
+
+  // and they behave like newly allocated fields
+  dx3 = dx1;
+  EXPECT(dx3.norm() == norm);
+  dx3 -= dx1;
+  EXPECT(dx3.norm() == 0.0);
+  EXPECT(dx1.norm() == norm);
+}
+
+// -----------------------------------------------------------------------------
+
+void testIncrementContiguousArena() {
+  eckit::LocalConfiguration arenaConfig(::test::TestEnvironment::config(), "geometry");
+  arenaConfig.set("contiguous increments", true);
+  const GeometryMPAS arenaGeometry(arenaConfig, geometry().getComm());
+  const oops::Variables & vars = Fixture::ctlvars();
+  const util::DateTime & time = Fixture::time();
+  const double tol = 1.0e-12;
+
+  // the same values stored field by field (dx) and in one arena (ax)
+  IncrementMPAS dx1(geometry(), vars, time);
+  IncrementMPAS dx2(geometry(), vars, time);
+  IncrementMPAS dx3(geometry(), vars, time);
+  dx1.random();
+  dx2.random();
+  dx3.random();
+  IncrementMPAS ax1(arenaGeometry, vars, time);
+  IncrementMPAS ax2(arenaGeometry, vars, time);
+  IncrementMPAS ax3(arenaGeometry, vars, time);
+  copyValues(dx1, ax1);
+  copyValues(dx2, ax2);
+  copyValues(dx3, ax3);
+  EXPECT(relativeDiff(ax1, dx1) == 0.0);
+
+  dx1.fused(0.5 * dx1 + 2.0 * dx2 - dx3);
+  ax1.fused(0.5 * ax1 + 2.0 * ax2 - ax3);
+  EXPECT(relativeDiff(ax1, dx1) <= tol);
+
+  dx2 *= 3.0;
+  ax2 *= 3.0;
+  dx2.axpy(-0.25, dx3);
+  ax2.axpy(-0.25, ax3);
+  EXPECT(relativeDiff(ax2, dx2) <= tol);
+
+  dx3.schur_product_with(dx1);
+  ax3.schur_product_with(ax1);
+  EXPECT(relativeDiff(ax3, dx3) <= tol);
+
+  const double dot = dx1.dot_product_with(dx2);
+  EXPECT(std::abs(ax1.dot_product_with(ax2) - dot) <= tol * std::abs(dot));
+  EXPECT(std::abs(ax1.norm() - dx1.norm()) <= tol * dx1.norm());
+
+  const double zprod = dx2.axpy_and_dot(1.5, dx1, dx3);
+  EXPECT(std::abs(ax2.axpy_and_dot(1.5, ax1, ax3) - zprod) <= tol * std::abs(zprod));
+  EXPECT(relativeDiff(ax2, dx2) <= tol);
+
+  // copies keep the storage of their geometry
+  IncrementMPAS ax4(ax2);
+  ax4 -= ax2;
+  EXPECT(ax4.norm() == 0.0);
+  ax4 = ax3;
+  EXPECT(relativeDiff(ax4, dx3) <= tol);
+}
+
+// -----------------------------------------------------------------------------
+
+/// Whether two global reductions agree to round-off
+bool sameSum(const double & zz, const double & ref) {
+  return std::abs(zz - ref) <= 1.0e-12 * std::abs(ref);
+}
+
+// -----------------------------------------------------------------------------
+
+void testIncrementBatchedReductions() {
+  IncrementMPAS dx(geometry(), Fixture::ctlvars(), Fixture::time());
+  IncrementMPAS dy1(geometry(), Fixture::ctlvars(), Fixture::time());
+  IncrementMPAS dy2(geometry(), Fixture::ctlvars(), Fixture::time());
+  IncrementMPAS dy3(geometry(), Fixture::ctlvars(), Fixture::time());
+  dx.random();
+  dy1.random();
+  dy2.random();
+  dy3.random();
+  dy2 *= 10.0;
+  const std::vector<const IncrementMPAS *> others{&dy1, &dy2, &dy3, &dx};
+
+  const std::vector<double> dots = dx.dot_products_with(others);
+  EXPECT(dots.size() == others.size());
+  for (std::size_t jj = 0; jj < others.size(); ++jj) {
+    EXPECT(sameSum(dots[jj], dx.dot_product_with(*others[jj])));
+  }
+
+  const std::vector<double> norms = IncrementMPAS::norms(others);
+  EXPECT(norms.size() == others.size());
+  for (std::size_t jj = 0; jj < others.size(); ++jj) {
+    EXPECT(sameSum(norms[jj], others[jj]->norm()));
+  }
+
+  EXPECT(dx.dot_products_with({}).empty());
+  EXPECT(IncrementMPAS::norms({}).empty());
+}
+
+// -----------------------------------------------------------------------------
+
+void testIncrementSplitPhaseDotProduct() {
+  IncrementMPAS dx(geometry(), Fixture::ctlvars(), Fixture::time());
+  IncrementMPAS dy(geometry(), Fixture::ctlvars(), Fixture::time());
+  dx.random();
+  dy.random();
+  const double ref = dx.dot_product_with(dy);
+
+  DotProductRequest request;
+  EXPECT(!request.pending());
+  dx.dot_product_start(dy, request);
+  EXPECT(request.pending());
+  EXPECT(sameSum(dx.dot_product_finish(request), ref));
+  EXPECT(!request.pending());
+
+  // other reductions may run while the sum is in flight, and a request can be reused
+  dx.dot_product_start(dy, request);
+  const double norm = dy.norm();
+  EXPECT(sameSum(dy.dot_product_with(dx), ref));
+  EXPECT(sameSum(dx.dot_product_finish(request), ref));
+  EXPECT(sameSum(dy.norm(), norm));
+
+  // an unfinished sum is waited for when its request goes away
+  {
+    DotProductRequest unfinished;
+    dx.dot_product_start(dy, unfinished);
+  }
+  EXPECT(sameSum(dx.dot_product_with(dy), ref));
+
+  // and the increment may go first
+  DotProductRequest orphan;
+  {
+    IncrementMPAS dz(dx);
+    dz.dot_product_start(dy, orphan);
+  }
+  EXPECT(orphan.pending());
+  EXPECT(sameSum(dx.dot_product_finish(orphan), ref));
+}
+
+// -----------------------------------------------------------------------------
+
+class Increment : public oops::Test {
+ public:
+  Increment() {}
+  virtual ~Increment() {Fixture::reset();}
+
+ private:
+  std::string testid() const override {return "mpas::test::Increment";}
+
+  void register_tests() const override {
+    std::vector<eckit::testing::Test>& ts = eckit::testing::specification();
+
+    ts.emplace_back(CASE("mpasjedi/Increment/testIncrementMoveConstructor")
+      { testIncrementMoveConstructor(); });
+    ts.emplace_back(CASE("mpasjedi/Increment/testIncrementMoveAssignment")
+      { testIncrementMoveAssignment(); });
+    ts.emplace_back(CASE("mpasjedi/Increment/testIncrementCopyIntoMovedFrom")
+      { testIncrementCopyIntoMovedFrom(); });
+    ts.emplace_back(CASE("mpasjedi/Increment/testIncrementDestroyMovedFrom")
+      { testIncrementDestroyMovedFrom(); });
+    ts.emplace_back(CASE("mpasjedi/Increment/testIncrementFieldPoolReuse")
+      { testIncrementFieldPoolReuse(); });
+    ts.emplace_back(CASE("mpasjedi/Increment/testIncrementContiguousArena")
+      { testIncrementContiguousArena(); });
+    ts.emplace_back(CASE("mpasjedi/Increment/testIncrementBatchedReductions")
+      { testIncrementBatchedReductions(); });
+    ts.emplace_back(CASE("mpasjedi/Increment/testIncrementSplitPhaseDotProduct")
+      { testIncrementSplitPhaseDotProduct(); });
+  }
+
+  void clear() const override {}
+};
+
+// -----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace mpas
+
+int main(int argc,  char ** argv) {
+  oops::Run run(argc, argv);
+  mpas::test::Increment tests;
+  return run.execute(tests);
+}